@@ -0,0 +1,80 @@
+#include "seq/seq.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+
+using sample = std::int32_t;
+using taps = seq::iseq<sample, 1, 0, -2, 0, 8, 0, -2, 0, 1>;
+
+constexpr std::size_t sample_count = 1ul << 20;
+constexpr std::size_t repetitions = 100ul;
+
+void naive_convolve(const std::vector<sample>& coefficients,
+                    const sample* in,
+                    sample* out,
+                    std::size_t n)
+{
+    const std::size_t length = coefficients.size();
+    for (std::size_t i = 0ul; i < n; ++i)
+    {
+        sample acc = 0;
+        for (std::size_t k = 0ul; k < length; ++k)
+        {
+            acc += coefficients[k] * in[i + length - 1 - k];
+        }
+        out[i] = acc;
+    }
+}
+
+template <typename F>
+double measure(F fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0ul; r < repetitions; ++r)
+    {
+        fn();
+    }
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(repetitions * sample_count);
+}
+
+}  // namespace
+
+int main()
+{
+    const std::vector<sample> coefficients = {1, 0, -2, 0, 8, 0, -2, 0, 1};
+    std::vector<sample> in(sample_count + taps::size() - 1);
+    std::vector<sample> expected(sample_count);
+    std::vector<sample> actual(sample_count);
+
+    std::uint32_t state = 1u;
+    for (sample& s : in)
+    {
+        state = state * 1664525u + 1013904223u;
+        s = static_cast<sample>(state >> 20);
+    }
+
+    const double naive_ns = measure([&] {
+        naive_convolve(coefficients, in.data(), expected.data(), sample_count);
+    });
+    const double seq_ns = measure([&] {
+        seq::convolve<taps>(in.data(), actual.data(), sample_count);
+    });
+
+    std::printf("naive loop:    %.3f ns/sample\n", naive_ns);
+    std::printf("seq::convolve: %.3f ns/sample\n", seq_ns);
+    std::printf("speedup:       %.2fx\n", naive_ns / seq_ns);
+
+    if (expected != actual)
+    {
+        std::printf("error: outputs differ\n");
+        return 1;
+    }
+    return 0;
+}
@@ -4,7 +4,11 @@
 #pragma warning(push)
 #pragma warning(disable : 4365 5026 5027)
 #endif
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -56,6 +60,45 @@ struct make
     using type = expand<Size, make_>;
 };
 
+/**
+ * Generate a sequence from the elements of a constexpr range, e.g. a
+ * std::array, a built-in array or a std::basic_string_view
+ */
+template <auto& Range>
+struct from_range
+{
+    using T = std::decay_t<decltype(*std::begin(Range))>;
+
+    template <std::size_t... Index>
+    using from_range_ = iseq<T, std::begin(Range)[Index]...>;
+    using type = expand<std::size(Range), from_range_>;
+};
+
+/**
+ * Generate a sequence from the elements of the constexpr range returned by the
+ * given function, which is evaluated only once
+ */
+template <auto& Function>
+struct from_function
+{
+    static constexpr auto values_ = Function();
+    using type = typename from_range<values_>::type;
+};
+
+/**
+ * Generate a sequence from either a constexpr array or from the array returned
+ * by the given function
+ */
+template <auto& Array, bool = std::is_invocable_v<decltype(Array)>>
+struct from_array : from_range<Array>
+{
+};
+
+template <auto& Function>
+struct from_array<Function, true> : from_function<Function>
+{
+};
+
 /**
  * Syntactic sugar to define function pointers
  */
@@ -325,22 +368,241 @@ struct split_at<T, I, iseq<T, Is...>> : split_at_l<T, I, Is...>
 };
 
 /**
- * Interleave elements of two sequences in their order of appearance
+ * Unpack elements of a sequence into an array of the requested value type
  */
-template <typename SequenceA, typename SequenceB>
-struct zip;
+template <typename T, typename Sequence>
+struct values;
 
-template <typename A, typename B>
-struct zip<iseq<A>, iseq<B>>
+template <typename T, typename U, U... Elements>
+struct values<T, iseq<U, Elements...>>
 {
-    using type = iseq<std::common_type_t<A, B>>;
+    static constexpr std::array<T, sizeof...(Elements)> value = {Elements...};
 };
 
-template <typename A, A... As, typename B, B... Bs>
-struct zip<iseq<A, As...>, iseq<B, Bs...>>
+/**
+ * Interleave elements of any number of sequences in their order of appearance,
+ * truncating all of them to the length of the shortest one
+ */
+template <typename Sequence, typename... Rest>
+struct zip
+{
+    using C = std::common_type_t<typename Sequence::value_type,
+                                 typename Rest::value_type...>;
+
+    static constexpr std::size_t count_ = sizeof...(Rest) + 1;
+    static constexpr std::size_t length_ = std::min({Sequence::size(),
+                                                     Rest::size()...});
+    static constexpr std::array<const C*, count_> values_ = {
+        values<C, Sequence>::value.data(),
+        values<C, Rest>::value.data()...};
+
+    template <std::size_t... Index>
+    using zip_ = iseq<C, values_[Index % count_][Index / count_]...>;
+    using type = expand<count_ * length_, zip_>;
+};
+
+/**
+ * Split sequence into N sequences, where the I-th one holds every N-th element
+ * of the original sequence, starting from the I-th element
+ */
+template <typename T, std::size_t Count, typename Sequence>
+struct unzip;
+
+template <typename T, std::size_t Count, T... Is>
+struct unzip<T, Count, iseq<T, Is...>>
+{
+    static_assert(Count > 0, "Requested count must be greater than zero.");
+
+    static constexpr std::array<T, sizeof...(Is)> values_ = {Is...};
+
+    template <std::size_t Offset>
+    struct stride_
+    {
+        template <std::size_t... Index>
+        using stride__ = iseq<T, values_[Offset + Index * Count]...>;
+        using type = expand<(sizeof...(Is) + Count - 1 - Offset) / Count,
+                            stride__>;
+    };
+
+    template <std::size_t... Offset>
+    struct unzip_
+    {
+        using type = std::tuple<typename stride_<Offset>::type...>;
+    };
+    using type = expand<Count, unzip_>;
+};
+
+/**
+ * Concatenate all windows of the given width that slide over the sequence one
+ * element at a time
+ */
+template <typename T, std::size_t Width, typename Sequence>
+struct window;
+
+template <typename T, std::size_t Width, T... Is>
+struct window<T, Width, iseq<T, Is...>>
+{
+    static_assert(Width > 0, "Requested width must be greater than zero.");
+
+    static constexpr std::array<T, sizeof...(Is)> values_ = {Is...};
+    static constexpr std::size_t count_ =
+        sizeof...(Is) < Width ? 0ul : sizeof...(Is) - Width + 1;
+
+    template <std::size_t... Index>
+    using window_ = iseq<T, values_[Index / Width + Index % Width]...>;
+    using type = expand<count_ * Width, window_>;
+};
+
+/**
+ * Generate a sequence by applying the specified function to each pair of
+ * elements at the same position in the two given sequences, truncating the
+ * longer sequence to the length of the shorter one
+ */
+template <typename T, fn_ptr<T, T, T, std::size_t> Function, typename SequenceA, typename SequenceB>
+struct zip_with
+{
+    static constexpr auto& as_ = values<T, SequenceA>::value;
+    static constexpr auto& bs_ = values<T, SequenceB>::value;
+
+    template <std::size_t... Index>
+    using zip_with_ = iseq<T, Function(as_[Index], bs_[Index], Index)...>;
+    using type = expand<std::min(SequenceA::size(), SequenceB::size()),
+                        zip_with_>;
+};
+
+/**
+ * Check whether the given value is representable by the requested type
+ */
+template <typename U, typename T>
+constexpr bool fits(T value)
+{
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (value < 0)
+        {
+            return std::is_signed_v<U> &&
+                   static_cast<std::intmax_t>(value) >=
+                       static_cast<std::intmax_t>(std::numeric_limits<U>::min());
+        }
+    }
+    return static_cast<std::uintmax_t>(value) <=
+           static_cast<std::uintmax_t>(std::numeric_limits<U>::max());
+}
+
+/**
+ * Select the narrowest integral type able to hold all values in the given range
+ */
+template <typename T, T Min, T Max>
+struct narrowest
+{
+    template <typename U>
+    static constexpr bool fits_ = fits<U>(Min) && fits<U>(Max);
+
+    using signed_ = std::conditional_t<
+        fits_<std::int8_t>,
+        std::int8_t,
+        std::conditional_t<
+            fits_<std::int16_t>,
+            std::int16_t,
+            std::conditional_t<fits_<std::int32_t>, std::int32_t, std::int64_t>>>;
+    using unsigned_ = std::conditional_t<
+        fits_<std::uint8_t>,
+        std::uint8_t,
+        std::conditional_t<
+            fits_<std::uint16_t>,
+            std::uint16_t,
+            std::conditional_t<fits_<std::uint32_t>, std::uint32_t, std::uint64_t>>>;
+    using type = std::conditional_t<fits<std::uintmax_t>(Min), unsigned_, signed_>;
+};
+
+/**
+ * Re-type the sequence to the narrowest integral type able to hold all of its
+ * elements
+ */
+template <typename T, typename Sequence>
+struct narrow;
+
+template <typename T>
+struct narrow<T, iseq<T>>
+{
+    using type = iseq<std::uint8_t>;
+};
+
+template <typename T, T... Is>
+struct narrow<T, iseq<T, Is...>>
 {
-    using C = std::common_type_t<A, B>;
-    using type = typename concat<iseq<C, As, Bs>...>::type;
+    using U = typename narrowest<T, std::min({Is...}), std::max({Is...})>::type;
+    using type = iseq<U, static_cast<U>(Is)...>;
+};
+
+/**
+ * Runtime lookup table holding the elements of the sequence in the narrowest
+ * possible type, either directly or as offsets from the smallest element when
+ * that allows a narrower type, and widening them back on access
+ */
+template <typename T, typename Sequence>
+struct compact_table;
+
+template <typename T>
+struct compact_table<T, iseq<T>>
+{
+    using value_type = T;
+    using storage_type = std::uint8_t;
+
+    static constexpr T base = T{};
+
+    static constexpr std::size_t size()
+    {
+        return 0ul;
+    }
+};
+
+template <typename T, T I, T... Is>
+struct compact_table<T, iseq<T, I, Is...>>
+{
+    using value_type = T;
+    using U = std::make_unsigned_t<T>;
+
+    static constexpr T min_ = std::min({I, Is...});
+    static constexpr T max_ = std::max({I, Is...});
+    static constexpr U range_ = static_cast<U>(static_cast<U>(max_) -
+                                               static_cast<U>(min_));
+
+    using direct_ = typename narrowest<T, min_, max_>::type;
+    using delta_ = typename narrowest<U, 0, range_>::type;
+
+    static constexpr bool is_delta_ = sizeof(delta_) < sizeof(direct_);
+
+    using storage_type = std::conditional_t<is_delta_, delta_, direct_>;
+
+    static constexpr T base = is_delta_ ? min_ : T{};
+
+    static constexpr storage_type encode_(T value)
+    {
+        if constexpr (is_delta_)
+        {
+            return static_cast<storage_type>(static_cast<U>(value) -
+                                             static_cast<U>(base));
+        }
+        else
+        {
+            return static_cast<storage_type>(value);
+        }
+    }
+
+    static constexpr std::array<storage_type, sizeof...(Is) + 1> values_ = {
+        encode_(I),
+        encode_(Is)...};
+
+    static constexpr std::size_t size()
+    {
+        return sizeof...(Is) + 1;
+    }
+
+    constexpr T operator[](std::size_t index) const
+    {
+        return static_cast<T>(base + values_[index]);
+    }
 };
 
 /**
@@ -417,11 +679,62 @@ struct insert<T, Index, Value, iseq<T, Skip, Elements...>>
         typename insert<T, Index - 1, Value, iseq<T, Elements...>>::type>::type;
 };
 
+/**
+ * Convolve the input signal with the given filter taps, emitting one multiply
+ * per non-zero tap for each output sample
+ */
+template <typename T, typename Taps>
+struct convolve;
+
+template <typename T, typename C, C... Cs>
+struct convolve<T, iseq<C, Cs...>>
+{
+    using A = decltype(std::declval<C>() * std::declval<T>());
+
+    static constexpr std::size_t length_ = sizeof...(Cs);
+    static constexpr std::array<C, length_> taps_ = {Cs...};
+
+    static constexpr bool is_nonzero(std::size_t tap, std::size_t /*unused*/)
+    {
+        return taps_[tap] != 0;
+    }
+
+    static constexpr std::size_t offset(std::size_t tap, std::size_t /*unused*/)
+    {
+        return length_ - 1 - tap;
+    }
+
+    using taps = typename filter<
+        std::size_t,
+        is_nonzero,
+        typename make<std::size_t, length_, 0, 1>::type>::type;
+    using offsets = typename map<std::size_t, offset, taps>::type;
+
+    template <std::size_t... Tap, std::size_t... Offset>
+    static constexpr void apply([[maybe_unused]] const T* in,
+                                T* out,
+                                std::size_t n,
+                                iseq<std::size_t, Tap...> /*unused*/,
+                                iseq<std::size_t, Offset...> /*unused*/)
+    {
+        for (std::size_t i = 0ul; i < n; ++i)
+        {
+            out[i] = static_cast<T>((A{} + ... + (taps_[Tap] * in[i + Offset])));
+        }
+    }
+};
+
 }  // namespace impl
 
 template <typename T, std::size_t N, T S = T{}, std::make_signed_t<T> I = 1>
 using make = typename impl::make<T, N, S, I>::type;
 
+template <auto& A>
+using from_array = typename impl::from_array<A>::type;
+
+template <auto& F>
+using from_range = typename impl::from_function<F>::type;
+
 template <typename SA, typename SB, typename... R>
 using concat = typename impl::concat<SA, SB, R...>::type;
 
@@ -461,8 +774,27 @@ using after = slice<SI, S::size() - SI, S>;
 template <std::size_t SI, typename S>
 using split_at = impl::split_at<typename S::value_type, SI, S>;
 
-template <typename SA, typename SB>
-using zip = typename impl::zip<SA, SB>::type;
+template <typename S, typename... R>
+using zip = typename impl::zip<S, R...>::type;
+
+template <std::size_t N, typename S>
+using unzip = typename impl::unzip<typename S::value_type, N, S>::type;
+
+template <std::size_t N, typename S>
+using window = typename impl::window<typename S::value_type, N, S>::type;
+
+template <auto F, typename SA, typename SB>
+using zip_with = typename impl::zip_with<
+    std::common_type_t<typename SA::value_type, typename SB::value_type>,
+    F,
+    SA,
+    SB>::type;
+
+template <typename S>
+using narrow = typename impl::narrow<typename S::value_type, S>::type;
+
+template <typename S>
+using compact_table = impl::compact_table<typename S::value_type, S>;
 
 template <auto V, typename S>
 static constexpr auto index_of = impl::index_of(V, S{});
@@ -491,4 +823,16 @@ using filter = typename impl::filter<typename S::value_type, F, S>::type;
 template <auto F, typename S, typename S::value_type I = typename S::value_type{}>
 static constexpr auto reduce = impl::reduce<typename S::value_type, F, I, 0, S>::value;
 
+/**
+ * Compute `n` output samples of the convolution of `in` with the filter taps,
+ * i.e. out[i] = sum(taps[k] * in[i + size(taps) - 1 - k]), hence `in` must
+ * hold at least `n + size(taps) - 1` samples
+ */
+template <typename Taps, typename T>
+constexpr void convolve(const T* in, T* out, std::size_t n)
+{
+    using C = impl::convolve<T, Taps>;
+    C::apply(in, out, n, typename C::taps{}, typename C::offsets{});
+}
+
 }  // namespace seq
@@ -1,5 +1,7 @@
 #include "seq/seq.h"
 
+#include <string_view>
+
 template <typename T, T... As, T... Bs>
 constexpr bool equals(seq::iseq<T, As...> /*unused*/, seq::iseq<T, Bs...> /*unused*/)
 {
@@ -23,6 +25,55 @@ static_assert(equals(seq::make<int, 3, 1, -1>{}, seq::iseq<int, 1, 0, -1>{}),
 static_assert(equals(seq::make<int, 3, 1, -3>{}, seq::iseq<int, 1, -2, -5>{}),
               "make_05");
 
+// Test `seq::from_array`
+constexpr std::array<int, 4> array_a = {0, 1, 2, 3};
+constexpr int builtin_array_b[] = {4, 5, 6, 7};
+
+constexpr std::array<int, 4> make_array_b()
+{
+    std::array<int, 4> result{};
+    for (std::size_t i = 0ul; i < result.size(); ++i)
+    {
+        result[i] = static_cast<int>(i) + 4;
+    }
+    return result;
+}
+
+constexpr std::array<int, 50000> make_large_array()
+{
+    std::array<int, 50000> result{};
+    for (std::size_t i = 0ul; i < result.size(); ++i)
+    {
+        result[i] = static_cast<int>(i);
+    }
+    return result;
+}
+
+constexpr std::array<int, 0> make_empty_array()
+{
+    return {};
+}
+
+static_assert(equals(seq::from_array<array_a>{}, seq_a{}), "from_array_01");
+static_assert(equals(seq::from_array<builtin_array_b>{}, seq_b{}),
+              "from_array_02");
+static_assert(equals(seq::from_array<make_array_b>{}, seq_b{}), "from_array_03");
+static_assert(equals(seq::from_array<make_empty_array>{}, seq::iseq<int>{}),
+              "from_array_04");
+static_assert(seq::from_array<make_large_array>::size() == 50000, "from_array_05");
+static_assert(seq::last<seq::from_array<make_large_array>> == 49999,
+              "from_array_06");
+
+// Test `seq::from_range`
+constexpr std::string_view make_string()
+{
+    return "seq";
+}
+
+static_assert(equals(seq::from_range<make_array_b>{}, seq_b{}), "from_range_01");
+static_assert(equals(seq::from_range<make_string>{}, seq::iseq<char, 's', 'e', 'q'>{}),
+              "from_range_02");
+
 // Test `seq::concat`
 static_assert(equals(seq::concat<seq_a, seq_b>{},
                      seq::iseq<int, 0, 1, 2, 3, 4, 5, 6, 7>{}),
@@ -143,6 +194,114 @@ static_assert(equals(seq::zip<seq_a, seq_b>{},
 static_assert(equals(seq::zip<seq_b, seq_a>{},
                      seq::iseq<int, 4, 0, 5, 1, 6, 2, 7, 3>{}),
               "zip_03");
+static_assert(equals(seq::zip<seq_a, seq_b, seq_a>{},
+                     seq::iseq<int, 0, 4, 0, 1, 5, 1, 2, 6, 2, 3, 7, 3>{}),
+              "zip_04");
+static_assert(equals(seq::zip<seq_a>{}, seq_a{}), "zip_05");
+// When lengths differ, `seq::zip` truncates to the shortest sequence
+static_assert(equals(seq::zip<seq_a, seq::iseq<int, 9, 8>>{},
+                     seq::iseq<int, 0, 9, 1, 8>{}),
+              "zip_06");
+static_assert(equals(seq::zip<seq_a, seq::iseq<long, 4, 5, 6, 7>>{},
+                     seq::iseq<long, 0, 4, 1, 5, 2, 6, 3, 7>{}),
+              "zip_07");
+static_assert(seq::zip<seq::make<int, 2000>, seq::make<int, 2000>, seq::make<int, 2000>>::size() == 6000,
+              "zip_08");
+
+// Test `seq::unzip`
+static_assert(equals(std::tuple_element_t<0, seq::unzip<2, seq::zip<seq_a, seq_b>>>{},
+                     seq_a{}),
+              "unzip_01");
+static_assert(equals(std::tuple_element_t<1, seq::unzip<2, seq::zip<seq_a, seq_b>>>{},
+                     seq_b{}),
+              "unzip_02");
+static_assert(equals(std::tuple_element_t<0, seq::unzip<3, seq::make<int, 7>>>{},
+                     seq::iseq<int, 0, 3, 6>{}),
+              "unzip_03");
+static_assert(equals(std::tuple_element_t<2, seq::unzip<3, seq::make<int, 7>>>{},
+                     seq::iseq<int, 2, 5>{}),
+              "unzip_04");
+static_assert(equals(std::tuple_element_t<0, seq::unzip<1, seq_a>>{}, seq_a{}),
+              "unzip_05");
+static_assert(std::tuple_size_v<seq::unzip<2, seq::iseq<int>>> == 2, "unzip_06");
+static_assert(equals(std::tuple_element_t<1, seq::unzip<2, seq::zip<seq::make<int, 2000>, seq::make<int, 2000, 1>>>>{},
+                     seq::make<int, 2000, 1>{}),
+              "unzip_07");
+
+// Test `seq::zip_with`
+constexpr int multiply(int a, int b, std::size_t /*unused*/)
+{
+    return a * b;
+}
+
+static_assert(equals(seq::zip_with<multiply, seq_a, seq_b>{},
+                     seq::iseq<int, 0, 5, 12, 21>{}),
+              "zip_with_01");
+static_assert(equals(seq::zip_with<multiply, seq_b, seq::iseq<int, 2, 3>>{},
+                     seq::iseq<int, 8, 15>{}),
+              "zip_with_02");
+static_assert(equals(seq::zip_with<multiply, seq::iseq<int>, seq_a>{},
+                     seq::iseq<int>{}),
+              "zip_with_03");
+
+// Test `seq::window`
+static_assert(equals(seq::window<2, seq_a>{}, seq::iseq<int, 0, 1, 1, 2, 2, 3>{}),
+              "window_01");
+static_assert(equals(seq::window<3, seq_b>{}, seq::iseq<int, 4, 5, 6, 5, 6, 7>{}),
+              "window_02");
+static_assert(equals(seq::window<1, seq_a>{}, seq_a{}), "window_03");
+static_assert(equals(seq::window<4, seq_a>{}, seq_a{}), "window_04");
+static_assert(equals(seq::window<5, seq_a>{}, seq::iseq<int>{}), "window_05");
+
+// Test `seq::narrow`
+static_assert(std::is_same_v<seq::narrow<seq_a>, seq::iseq<std::uint8_t, 0, 1, 2, 3>>,
+              "narrow_01");
+static_assert(std::is_same_v<seq::narrow<seq::iseq<long, -1, 127>>,
+                             seq::iseq<std::int8_t, -1, 127>>,
+              "narrow_02");
+static_assert(std::is_same_v<seq::narrow<seq::iseq<int, -1, 128>>,
+                             seq::iseq<std::int16_t, -1, 128>>,
+              "narrow_03");
+static_assert(std::is_same_v<seq::narrow<seq::iseq<std::size_t, 256>>,
+                             seq::iseq<std::uint16_t, 256>>,
+              "narrow_04");
+static_assert(std::is_same_v<seq::narrow<seq::iseq<long long, 1ll << 40>>,
+                             seq::iseq<std::uint64_t, 1ull << 40>>,
+              "narrow_05");
+static_assert(std::is_same_v<seq::narrow<seq::iseq<int>>, seq::iseq<std::uint8_t>>,
+              "narrow_06");
+static_assert(std::is_same_v<seq::concat<seq::narrow<seq_a>, seq::narrow<seq_b>>,
+                             seq::iseq<std::uint8_t, 0, 1, 2, 3, 4, 5, 6, 7>>,
+              "narrow_07");
+
+// Test `seq::compact_table`
+using table_a = seq::compact_table<seq::iseq<std::size_t, 3, 1, 255>>;
+using table_b = seq::compact_table<seq::iseq<int, 100000, 100200, 100017>>;
+using table_c = seq::compact_table<seq::iseq<int, -70000, 5, -3>>;
+using table_d = seq::compact_table<seq::iseq<int, -200, 0, 100>>;
+
+static_assert(std::is_same_v<table_a::storage_type, std::uint8_t>,
+              "compact_table_01");
+static_assert(table_a::base == 0ul, "compact_table_02");
+static_assert(table_a{}[0] == 3ul && table_a{}[1] == 1ul && table_a{}[2] == 255ul,
+              "compact_table_03");
+static_assert(std::is_same_v<table_b::storage_type, std::uint8_t>,
+              "compact_table_04");
+static_assert(table_b::base == 100000, "compact_table_05");
+static_assert(table_b{}[0] == 100000 && table_b{}[1] == 100200 &&
+                  table_b{}[2] == 100017,
+              "compact_table_06");
+static_assert(std::is_same_v<table_c::storage_type, std::int32_t>,
+              "compact_table_07");
+static_assert(table_c{}[0] == -70000 && table_c{}[1] == 5 && table_c{}[2] == -3,
+              "compact_table_08");
+static_assert(std::is_same_v<table_d::storage_type, std::int16_t>,
+              "compact_table_09");
+static_assert(table_d{}[0] == -200 && table_d{}[1] == 0 && table_d{}[2] == 100,
+              "compact_table_10");
+static_assert(table_a::size() == 3ul, "compact_table_11");
+static_assert(seq::compact_table<seq::iseq<int>>::size() == 0ul,
+              "compact_table_12");
 
 // Test `seq::index_of`
 static_assert(seq::index_of<4, seq_b> == 0, "index_of_01");
@@ -246,6 +405,47 @@ constexpr int sum_indices(int acc, int /*unused*/, std::size_t i)
 static_assert(seq::reduce<sum_indices, seq_a> == 6, "reduce_03");
 static_assert(seq::reduce<sum_indices, seq_b> == 6, "reduce_04");
 
+// Test `seq::convolve`
+template <typename Taps, std::size_t N, std::size_t M>
+constexpr std::array<int, N> convolved(const std::array<int, M>& in)
+{
+    std::array<int, N> out{};
+    seq::convolve<Taps>(in.data(), out.data(), N);
+    return out;
+}
+
+template <std::size_t N>
+constexpr bool equals(const std::array<int, N>& a, const std::array<int, N>& b)
+{
+    for (std::size_t i = 0ul; i < N; ++i)
+    {
+        if (a[i] != b[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr std::array<int, 6> signal = {1, 2, 3, 4, 5, 6};
+
+static_assert(equals(convolved<seq::iseq<int, 1>, 6>(signal), signal), "convolve_01");
+static_assert(equals(convolved<seq::iseq<int, 1, 2, 1>, 4>(signal),
+                     std::array<int, 4>{8, 12, 16, 20}),
+              "convolve_02");
+static_assert(equals(convolved<seq::iseq<int, 1, 0, -1>, 4>(signal),
+                     std::array<int, 4>{2, 2, 2, 2}),
+              "convolve_03");
+static_assert(equals(convolved<seq::iseq<int, 0, 4, 0>, 4>(signal),
+                     std::array<int, 4>{8, 12, 16, 20}),
+              "convolve_04");
+static_assert(equals(convolved<seq::iseq<int, 0, 0>, 5>(signal),
+                     std::array<int, 5>{}),
+              "convolve_05");
+static_assert(equals(convolved<seq::iseq<int, 3, 0, 0, 0, 0, 0>, 1>(signal),
+                     std::array<int, 1>{18}),
+              "convolve_06");
+
 // If it compiles, the tests have passed
 int main()
 {